@@ -81,6 +81,61 @@ typedef int (*jit_on_demand_func)(jit_function_t func);
  */
 typedef void *(*jit_on_demand_driver_func)(jit_function_t func);
 
+/*
+ * Result values for the "start_function" and "end_function" callbacks
+ * of a memory manager.
+ */
+#define	JIT_MEMORY_OK		0	/* Function is OK */
+#define	JIT_MEMORY_RESTART	1	/* Restart is required */
+#define	JIT_MEMORY_TOO_BIG	2	/* Function is too big for the cache */
+#define	JIT_MEMORY_ERROR	3	/* Other error */
+
+/*
+ * Opaque handles used by memory managers.
+ */
+typedef void *jit_memory_context_t;
+typedef void *jit_function_info_t;
+
+/*
+ * Memory manager that owns the code cache, function objects, trampolines
+ * and closures of a context.
+ */
+typedef struct jit_memory_manager const *jit_memory_manager_t;
+struct jit_memory_manager
+{
+	jit_memory_context_t (*create)(jit_context_t context);
+	void (*destroy)(jit_memory_context_t memctx);
+
+	jit_function_info_t (*find_function_info)
+		(jit_memory_context_t memctx, void *pc);
+	jit_function_t (*get_function)
+		(jit_memory_context_t memctx, jit_function_info_t info);
+	void *(*get_function_start)
+		(jit_memory_context_t memctx, jit_function_info_t info);
+	void *(*get_function_end)
+		(jit_memory_context_t memctx, jit_function_info_t info);
+
+	jit_function_t (*alloc_function)(jit_memory_context_t memctx);
+	void (*free_function)(jit_memory_context_t memctx, jit_function_t func);
+
+	int (*start_function)(jit_memory_context_t memctx, jit_function_t func);
+	int (*end_function)(jit_memory_context_t memctx, int result);
+	int (*extend_limit)(jit_memory_context_t memctx, int count);
+
+	void *(*get_limit)(jit_memory_context_t memctx);
+	void *(*get_break)(jit_memory_context_t memctx);
+	void (*set_break)(jit_memory_context_t memctx, void *brk);
+
+	void *(*alloc_trampoline)(jit_memory_context_t memctx);
+	void (*free_trampoline)(jit_memory_context_t memctx, void *ptr);
+
+	void *(*alloc_closure)(jit_memory_context_t memctx);
+	void (*free_closure)(jit_memory_context_t memctx, void *ptr);
+
+	void *(*alloc_data)
+		(jit_memory_context_t memctx, jit_nuint size, jit_nuint align);
+};
+
 
 /*
  * Pre-defined type descriptors.
@@ -254,6 +309,11 @@ void jit_context_set_on_demand_driver(
 	jit_context_t context,
 	jit_on_demand_driver_func driver);
 
+jit_memory_manager_t jit_default_memory_manager(void);
+void jit_context_set_memory_manager(
+	jit_context_t context,
+	jit_memory_manager_t manager);
+
 int jit_context_set_meta
 	(jit_context_t context, int type, void *data,
 	 jit_meta_free_func free_data);
@@ -392,6 +452,34 @@ unsigned int jit_get_closure_alignment(void);
 unsigned int jit_get_trampoline_size(void);
 unsigned int jit_get_trampoline_alignment(void);
 
+/*
+ * Builtin exception type codes, and result values for intrinsic functions.
+ */
+#define	JIT_RESULT_OK				(1)
+#define	JIT_RESULT_OVERFLOW			(0)
+#define	JIT_RESULT_ARITHMETIC		(-1)
+#define	JIT_RESULT_DIVISION_BY_ZERO	(-2)
+#define	JIT_RESULT_COMPILE_ERROR	(-3)
+#define	JIT_RESULT_OUT_OF_MEMORY	(-4)
+#define	JIT_RESULT_NULL_REFERENCE	(-5)
+#define	JIT_RESULT_NULL_FUNCTION	(-6)
+#define	JIT_RESULT_CALLED_NESTED	(-7)
+#define	JIT_RESULT_OUT_OF_BOUNDS	(-8)
+#define	JIT_RESULT_UNDEFINED_LABEL	(-9)
+#define	JIT_RESULT_MEMORY_FULL		(-10000)
+
+/*
+ * Exception handling function for builtin exceptions.
+ */
+typedef void *(*jit_exception_func)(int exception_type);
+
+void *jit_exception_get_last(void);
+void *jit_exception_get_last_and_clear(void);
+void jit_exception_set_last(void *object);
+void jit_exception_clear_last(void);
+jit_exception_func jit_exception_set_handler(jit_exception_func handler);
+jit_exception_func jit_exception_get_handler(void);
+
 /*
  * Descriptor for an intrinsic function.
  */